@@ -73,6 +73,27 @@ def check_output_exact_line(output, expected_line):
             return True
     return False
 
+def write_pattern_file(size, flip_offset=None):
+    """Write a deterministic byte pattern to a temp file and return its path"""
+    pattern = bytes((i * 31 + 7) & 0xff for i in range(256))
+    data = bytearray(pattern * (size // 256 + 1))[:size]
+    if flip_offset is not None:
+        data[flip_offset] ^= 0xff
+    with tempfile.NamedTemporaryFile(delete=False) as f:
+        f.write(data)
+        return f.name
+
+def write_sparse_file(size, data_offset, data, dense=False):
+    """Write data at data_offset in a file of the given size, leaving a hole
+    around it unless dense is set, and return its path"""
+    with tempfile.NamedTemporaryFile(delete=False) as f:
+        if dense:
+            f.write(bytes(size))
+        f.seek(data_offset)
+        f.write(data)
+        f.truncate(size)
+        return f.name
+
 # ============================================================================
 # MODULE TESTS - Test individual commands
 # ============================================================================
@@ -238,6 +259,48 @@ def test_jobs_with_background():
                      expected='job listing with sleep', 
                      actual=stdout)
 
+def test_jobs_listing_order():
+    """Test jobs lists one '[id] command: ...' line per job, sorted by ID"""
+    stdout, stderr, code = run_smash([
+        'sleep 100 &',  # job 0
+        'sleep 101 &',  # job 1
+        'sleep 102 &',  # job 2
+        'kill 9 0',
+        'sleep 1',      # let job 0 be reaped
+        'sleep 103 &',  # refills job 0, inserted last
+        'jobs',
+        'quit kill'
+    ], timeout=20)
+    if stdout is None:
+        return TestResult('jobs_listing_order', False, error='Timeout or error')
+    
+    lines = [l.strip() for l in stdout.replace('smash > ', '\n').split('\n')]
+    entries = [l for l in lines if l.startswith('[') and ':' in l]
+    prefixes = ['[0] sleep 103', '[1] sleep 101', '[2] sleep 102']
+    if len(entries) == 3 and all(e.startswith(p) for e, p in zip(entries, prefixes)):
+        return TestResult('jobs_listing_order', True)
+    return TestResult('jobs_listing_order', False,
+                     expected='jobs 0, 1, 2 in order',
+                     actual=stdout)
+
+def test_jobs_mixed_commands():
+    """Test jobs keeps each command line, arguments included, for mixed commands"""
+    stdout, stderr, code = run_smash([
+        'sleep 100 &',
+        'tail -f /dev/null &',
+        'sleep 200 &',
+        'jobs',
+        'quit kill'
+    ], timeout=20)
+    if stdout is None:
+        return TestResult('jobs_mixed_commands', False, error='Timeout or error')
+    
+    if check_output_contains(stdout, ['[0] sleep 100', '[1] tail -f /dev/null', '[2] sleep 200']):
+        return TestResult('jobs_mixed_commands', True)
+    return TestResult('jobs_mixed_commands', False,
+                     expected='sleep, tail and sleep jobs with arguments',
+                     actual=stdout)
+
 def test_kill_job():
     """Test kill command"""
     stdout, stderr, code = run_smash(['sleep 100 &', 'kill 9 0', 'quit'], timeout=5)
@@ -263,6 +326,20 @@ def test_kill_nonexistent():
                      expected='job id 99 does not exist', 
                      actual=combined)
 
+def test_kill_finished_job():
+    """Test kill on a job that exited before the kill command"""
+    stdout, stderr, code = run_smash(['sleep 1 &', 'sleep 2', 'kill 9 0', 'quit'], timeout=10)
+    if stdout is None:
+        return TestResult('kill_finished_job', False, error='Timeout or error')
+    
+    # The job is gone, so no signal may be sent to its (reusable) pid
+    combined = stdout + stderr
+    if 'job id 0 does not exist' in combined and 'was sent to pid' not in combined:
+        return TestResult('kill_finished_job', True)
+    return TestResult('kill_finished_job', False,
+                     expected='job id 0 does not exist',
+                     actual=combined)
+
 def test_kill_invalid_args():
     """Test kill with invalid arguments"""
     stdout, stderr, code = run_smash(['kill abc 0', 'quit'])
@@ -318,6 +395,272 @@ def test_diff_different_files():
         os.unlink(file1)
         os.unlink(file2)
 
+def test_diff_empty_files():
+    """Test diff with empty files against empty and non-empty files"""
+    with tempfile.NamedTemporaryFile(mode='w', delete=False) as f1:
+        empty1 = f1.name
+    with tempfile.NamedTemporaryFile(mode='w', delete=False) as f2:
+        empty2 = f2.name
+    with tempfile.NamedTemporaryFile(mode='w', delete=False) as f3:
+        f3.write('x')
+        nonempty = f3.name
+    
+    try:
+        stdout, stderr, code = run_smash([
+            'diff {} {}'.format(empty1, empty2),
+            'diff {} {}'.format(empty1, nonempty),
+            'diff {} {}'.format(nonempty, empty1),
+            'quit'
+        ])
+        if stdout is None:
+            return TestResult('diff_empty_files', False, error='Timeout or error')
+        
+        results = stdout.replace('smash > ', '\n').split()
+        if results == ['0', '1', '1']:
+            return TestResult('diff_empty_files', True)
+        return TestResult('diff_empty_files', False, expected='0, 1, 1', actual=stdout)
+    finally:
+        os.unlink(empty1)
+        os.unlink(empty2)
+        os.unlink(nonempty)
+
+def test_diff_multiline_output():
+    """Test diff prints only 0/1 (no hunks) for multi-line files"""
+    with tempfile.NamedTemporaryFile(mode='w', delete=False) as f1:
+        f1.write('alpha\nbeta\ngamma\ndelta\n')
+        file1 = f1.name
+    with tempfile.NamedTemporaryFile(mode='w', delete=False) as f2:
+        f2.write('alpha\nbeta\nGAMMA\ndelta\n')
+        file2 = f2.name
+    with tempfile.NamedTemporaryFile(mode='w', delete=False) as f3:
+        f3.write('alpha\nbeta\ngamma\ndelta')
+        file3 = f3.name
+    
+    try:
+        stdout, stderr, code = run_smash([
+            'diff {} {}'.format(file1, file2),
+            'diff {} {}'.format(file1, file3),
+            'quit'
+        ])
+        if stdout is None:
+            return TestResult('diff_multiline_output', False, error='Timeout or error')
+        
+        results = stdout.replace('smash > ', '\n').split()
+        if results == ['1', '1']:
+            return TestResult('diff_multiline_output', True)
+        return TestResult('diff_multiline_output', False, expected='1 twice, nothing else', actual=stdout)
+    finally:
+        os.unlink(file1)
+        os.unlink(file2)
+        os.unlink(file3)
+
+def test_diff_large_files():
+    """Test diff with large files, identical and differing in the last byte"""
+    size = 8 * 1024 * 1024 + 13
+    file1 = write_pattern_file(size)
+    file2 = write_pattern_file(size)
+    file3 = write_pattern_file(size, flip_offset=size - 1)
+    
+    try:
+        stdout, stderr, code = run_smash([
+            'diff {} {}'.format(file1, file2),
+            'diff {} {}'.format(file1, file3),
+            'quit'
+        ], timeout=30)
+        if stdout is None:
+            return TestResult('diff_large_files', False, error='Timeout or error')
+        
+        results = stdout.replace('smash > ', '\n').split()
+        if results == ['0', '1']:
+            return TestResult('diff_large_files', True)
+        return TestResult('diff_large_files', False, expected='0 then 1', actual=stdout)
+    finally:
+        os.unlink(file1)
+        os.unlink(file2)
+        os.unlink(file3)
+
+def test_diff_large_range_boundaries():
+    """Test diff with large files differing at the start and around the midpoint"""
+    size = 32 * 1024 * 1024 + 1
+    boundary = 16 * 1024 * 1024
+    base = write_pattern_file(size)
+    variants = [write_pattern_file(size, flip_offset=off) for off in (0, boundary - 1, boundary)]
+    
+    try:
+        commands = ['diff {} {}'.format(base, v) for v in variants]
+        commands.append('quit')
+        stdout, stderr, code = run_smash(commands, timeout=60)
+        if stdout is None:
+            return TestResult('diff_large_range_boundaries', False, error='Timeout or error')
+        
+        results = stdout.replace('smash > ', '\n').split()
+        if results == ['1', '1', '1']:
+            return TestResult('diff_large_range_boundaries', True)
+        return TestResult('diff_large_range_boundaries', False, expected='1 three times', actual=stdout)
+    finally:
+        os.unlink(base)
+        for v in variants:
+            os.unlink(v)
+
+def test_diff_shared_prefix():
+    """Test diff with differences just inside and just past a 4 KiB prefix"""
+    base = write_pattern_file(65536)
+    inside = write_pattern_file(65536, flip_offset=4095)
+    past = write_pattern_file(65536, flip_offset=4096)
+    
+    try:
+        stdout, stderr, code = run_smash([
+            'diff {} {}'.format(base, inside),
+            'diff {} {}'.format(base, past),
+            'quit'
+        ])
+        if stdout is None:
+            return TestResult('diff_shared_prefix', False, error='Timeout or error')
+        
+        results = stdout.replace('smash > ', '\n').split()
+        if results == ['1', '1']:
+            return TestResult('diff_shared_prefix', True)
+        return TestResult('diff_shared_prefix', False, expected='1 twice', actual=stdout)
+    finally:
+        os.unlink(base)
+        os.unlink(inside)
+        os.unlink(past)
+
+def test_diff_size_mismatch():
+    """Test diff with files sharing a prefix but differing in size"""
+    file1 = write_pattern_file(100000)
+    file2 = write_pattern_file(100001)
+    
+    try:
+        stdout, stderr, code = run_smash(['diff {} {}'.format(file1, file2), 'quit'])
+        if stdout is None:
+            return TestResult('diff_size_mismatch', False, error='Timeout or error')
+        
+        if check_output_exact_line(stdout, '1'):
+            return TestResult('diff_size_mismatch', True)
+        return TestResult('diff_size_mismatch', False, expected='1', actual=stdout)
+    finally:
+        os.unlink(file1)
+        os.unlink(file2)
+
+def test_diff_same_inode():
+    """Test diff with a file against itself, a hardlink and a symlink"""
+    with tempfile.NamedTemporaryFile(mode='w', delete=False) as f1:
+        f1.write('shared content\n')
+        file1 = f1.name
+    hardlink = file1 + '_hardlink'
+    symlink = file1 + '_symlink'
+    os.link(file1, hardlink)
+    os.symlink(file1, symlink)
+    
+    try:
+        stdout, stderr, code = run_smash([
+            'diff {} {}'.format(file1, file1),
+            'diff {} {}'.format(file1, hardlink),
+            'diff {} {}'.format(symlink, file1),
+            'quit'
+        ])
+        if stdout is None:
+            return TestResult('diff_same_inode', False, error='Timeout or error')
+        
+        results = stdout.replace('smash > ', '\n').split()
+        if results == ['0', '0', '0']:
+            return TestResult('diff_same_inode', True)
+        return TestResult('diff_same_inode', False, expected='0 three times', actual=stdout)
+    finally:
+        os.unlink(symlink)
+        os.unlink(hardlink)
+        os.unlink(file1)
+
+def test_diff_sparse_files():
+    """Test diff with sparse files whose hole maps match or differ"""
+    size = 16 * 1024 * 1024
+    offset = 4 * 1024 * 1024
+    sparse1 = write_sparse_file(size, offset, b'sparse data')
+    sparse2 = write_sparse_file(size, offset, b'sparse data')
+    dense = write_sparse_file(size, offset, b'sparse data', dense=True)
+    moved = write_sparse_file(size, offset * 2, b'sparse data')
+    
+    try:
+        stdout, stderr, code = run_smash([
+            'diff {} {}'.format(sparse1, sparse2),
+            'diff {} {}'.format(sparse1, dense),
+            'diff {} {}'.format(sparse1, moved),
+            'quit'
+        ], timeout=30)
+        if stdout is None:
+            return TestResult('diff_sparse_files', False, error='Timeout or error')
+        
+        results = stdout.replace('smash > ', '\n').split()
+        if results == ['0', '0', '1']:
+            return TestResult('diff_sparse_files', True)
+        return TestResult('diff_sparse_files', False, expected='0, 0, 1', actual=stdout)
+    finally:
+        for path in (sparse1, sparse2, dense, moved):
+            os.unlink(path)
+
+def test_diff_after_rewrite():
+    """Test diff notices a file rewritten in place within one smash session"""
+    with tempfile.NamedTemporaryFile(mode='w', delete=False) as f1:
+        f1.write('same size content A\n')
+        file1 = f1.name
+    with tempfile.NamedTemporaryFile(mode='w', delete=False) as f2:
+        f2.write('same size content A\n')
+        file2 = f2.name
+    with tempfile.NamedTemporaryFile(mode='w', delete=False) as f3:
+        f3.write('same size content B\n')
+        file3 = f3.name
+    
+    try:
+        # cp onto an existing file keeps its inode and size, so only the
+        # content (and mtime) changes between the two diffs
+        stdout, stderr, code = run_smash([
+            'diff {} {}'.format(file1, file2),
+            'cp {} {}'.format(file3, file1),
+            'diff {} {}'.format(file1, file2),
+            'quit'
+        ])
+        if stdout is None:
+            return TestResult('diff_after_rewrite', False, error='Timeout or error')
+        
+        results = stdout.replace('smash > ', '\n').split()
+        if results == ['0', '1']:
+            return TestResult('diff_after_rewrite', True)
+        return TestResult('diff_after_rewrite', False, expected='0 then 1', actual=stdout)
+    finally:
+        os.unlink(file1)
+        os.unlink(file2)
+        os.unlink(file3)
+
+def test_diff_after_rewrite_between_runs():
+    """Test diff notices a file rewritten in place between two smash runs"""
+    with tempfile.NamedTemporaryFile(mode='w', delete=False) as f1:
+        f1.write('same size content A\n')
+        file1 = f1.name
+    with tempfile.NamedTemporaryFile(mode='w', delete=False) as f2:
+        f2.write('same size content A\n')
+        file2 = f2.name
+    
+    try:
+        first, stderr, code = run_smash(['diff {} {}'.format(file1, file2), 'quit'])
+        
+        # Same inode and size, different content
+        with open(file1, 'r+') as f:
+            f.write('same size content B\n')
+        
+        second, stderr, code = run_smash(['diff {} {}'.format(file1, file2), 'quit'])
+        if first is None or second is None:
+            return TestResult('diff_after_rewrite_between_runs', False, error='Timeout or error')
+        
+        if check_output_exact_line(first, '0') and check_output_exact_line(second, '1'):
+            return TestResult('diff_after_rewrite_between_runs', True)
+        return TestResult('diff_after_rewrite_between_runs', False,
+                         expected='0 before and 1 after rewrite',
+                         actual='before: {}, after: {}'.format(first, second))
+    finally:
+        os.unlink(file1)
+        os.unlink(file2)
+
 def test_diff_nonexistent():
     """Test diff with nonexistent file"""
     stdout, stderr, code = run_smash(['diff /nonexistent1 /nonexistent2', 'quit'])
@@ -344,6 +687,30 @@ def test_diff_directory():
                      expected='paths are not files', 
                      actual=combined)
 
+def test_diff_file_and_directory():
+    """Test diff with a file and a directory in either order"""
+    with tempfile.NamedTemporaryFile(mode='w', delete=False) as f1:
+        f1.write('content\n')
+        file1 = f1.name
+    
+    try:
+        stdout, stderr, code = run_smash([
+            'diff {} /tmp'.format(file1),
+            'diff /tmp {}'.format(file1),
+            'quit'
+        ])
+        if stdout is None:
+            return TestResult('diff_file_and_directory', False, error='Timeout or error')
+        
+        combined = stdout + stderr
+        if combined.count('paths are not files') == 2:
+            return TestResult('diff_file_and_directory', True)
+        return TestResult('diff_file_and_directory', False,
+                         expected='paths are not files (twice)',
+                         actual=combined)
+    finally:
+        os.unlink(file1)
+
 def test_diff_wrong_args():
     """Test diff with wrong number of arguments"""
     stdout, stderr, code = run_smash(['diff /tmp', 'quit'])
@@ -377,6 +744,24 @@ def test_quit_kill():
                      expected='SIGTERM messages and exit 0', 
                      actual='stdout: {}, code: {}'.format(stdout, code))
 
+def test_quit_kill_many_jobs():
+    """Test quit kill with many jobs reports each job in order"""
+    commands = ['sleep 100 &' for _ in range(10)]
+    commands.append('quit kill')
+    
+    stdout, stderr, code = run_smash(commands, timeout=15)
+    if stdout is None:
+        return TestResult('quit_kill_many_jobs', False, error='Timeout or error')
+    
+    # Each job gets its own SIGTERM line, in increasing job ID order
+    lines = [l for l in stdout.replace('smash > ', '\n').split('\n') if 'SIGTERM' in l]
+    expected = ['[{}]'.format(i) for i in range(10)]
+    if [l.split()[0] for l in lines] == expected and code == 0:
+        return TestResult('quit_kill_many_jobs', True)
+    return TestResult('quit_kill_many_jobs', False,
+                     expected='SIGTERM lines for jobs 0-9 in order and exit 0',
+                     actual='stdout: {}, code: {}'.format(stdout, code))
+
 def test_quit_invalid_arg():
     """Test quit with invalid argument"""
     stdout, stderr, code = run_smash(['quit foo', 'quit'])
@@ -412,6 +797,56 @@ def test_external_echo():
         return TestResult('external_echo', True)
     return TestResult('external_echo', False, expected='hello world', actual=stdout)
 
+def test_external_lookup_repeated():
+    """Test repeated lookups of missing and existing external commands"""
+    stdout, stderr, code = run_smash([
+        'thiscommanddoesnotexist12345',
+        '/bin/echo absolute',
+        'thiscommanddoesnotexist12345',
+        'echo relative',
+        'quit'
+    ])
+    if stdout is None:
+        return TestResult('external_lookup_repeated', False, error='Timeout or error')
+    
+    # Each of the two lookups must report its own failure
+    combined = stdout + stderr
+    error_lines = [l for l in stderr.split('\n') if 'error' in l]
+    if len(error_lines) >= 2 and check_output_contains(stdout, ['absolute', 'relative']):
+        return TestResult('external_lookup_repeated', True)
+    return TestResult('external_lookup_repeated', False,
+                     expected='one error line per failed lookup plus both echo outputs',
+                     actual=combined)
+
+def test_external_cwd():
+    """Test external commands run in smash's current directory after cd"""
+    # /bin/pwd is the external binary, not the pwd built-in
+    stdout, stderr, code = run_smash(['cd /tmp', '/bin/pwd', 'cd /var', '/bin/pwd', 'quit'])
+    if stdout is None:
+        return TestResult('external_cwd', False, error='Timeout or error')
+    
+    lines = [l.strip() for l in stdout.replace('smash > ', '\n').split('\n') if l.strip()]
+    if lines == ['/tmp', '/var']:
+        return TestResult('external_cwd', True)
+    return TestResult('external_cwd', False, expected='/tmp then /var', actual=stdout)
+
+def test_whitespace_between_args():
+    """Test runs of spaces and tabs between arguments"""
+    stdout, stderr, code = run_smash(['   echo   spaced \t\t args   ', '\tpwd\t', 'quit'])
+    if stdout is None:
+        return TestResult('whitespace_between_args', False, error='Timeout or error')
+    
+    # Runs of whitespace separate arguments and never become empty tokens;
+    # the tab-wrapped pwd must run the built-in and print smash's cwd
+    combined = stdout + stderr
+    if (check_output_exact_line(stdout, 'spaced args') and
+            check_output_exact_line(stdout, os.getcwd()) and
+            'expected 0 arguments' not in combined):
+        return TestResult('whitespace_between_args', True)
+    return TestResult('whitespace_between_args', False,
+                     expected='spaced args, {} and no argument errors'.format(os.getcwd()),
+                     actual=combined)
+
 def test_external_background():
     """Test external command in background"""
     stdout, stderr, code = run_smash(['sleep 5 &', 'jobs', 'quit kill'], timeout=10)
@@ -492,6 +927,82 @@ def test_complex_command_fail():
                      expected='should_not_appear NOT in output', 
                      actual=stdout)
 
+def test_true_false_chain():
+    """Test && follows the exit status of true and false"""
+    stdout, stderr, code = run_smash([
+        'true && echo after_true',
+        'false && echo after_false',
+        'echo first && false && echo after_middle_false',
+        'quit'
+    ])
+    if stdout is None:
+        return TestResult('true_false_chain', False, error='Timeout or error')
+    
+    if (check_output_contains(stdout, ['after_true', 'first']) and
+            'after_false' not in stdout and 'after_middle_false' not in stdout):
+        return TestResult('true_false_chain', True)
+    return TestResult('true_false_chain', False,
+                     expected='only after_true and first',
+                     actual=stdout)
+
+def test_external_status_chain():
+    """Test && follows the exit status of a foreground external command"""
+    stdout, stderr, code = run_smash([
+        'ls /this/path/does/not/exist && echo after_failed_ls',
+        'ls / && echo after_ls',
+        'quit'
+    ])
+    if stdout is None:
+        return TestResult('external_status_chain', False, error='Timeout or error')
+    
+    if 'after_ls' in stdout and 'after_failed_ls' not in stdout:
+        return TestResult('external_status_chain', True)
+    return TestResult('external_status_chain', False,
+                     expected='only after_ls',
+                     actual=stdout)
+
+def test_background_own_process_group():
+    """Test that a background external job leads its own process group"""
+    try:
+        proc = subprocess.Popen(
+            [SMASH_PATH],
+            stdin=subprocess.PIPE,
+            stdout=subprocess.PIPE,
+            stderr=subprocess.PIPE,
+            universal_newlines=True
+        )
+        proc.stdin.write('sleep 100 &\n')
+        proc.stdin.flush()
+        time.sleep(0.5)
+        
+        # Find smash's children through /proc; field 4 of stat is the ppid
+        children = []
+        for entry in os.listdir('/proc'):
+            if not entry.isdigit():
+                continue
+            try:
+                with open('/proc/{}/stat'.format(entry)) as f:
+                    fields = f.read().rsplit(')', 1)[1].split()
+            except (IOError, OSError):
+                continue
+            if int(fields[1]) == proc.pid:
+                children.append(int(entry))
+        groups = [os.getpgid(pid) for pid in children]
+        smash_group = os.getpgid(proc.pid)
+        
+        stdout, stderr = proc.communicate(input='quit kill\n', timeout=10)
+    except subprocess.TimeoutExpired:
+        proc.kill()
+        return TestResult('background_own_process_group', False, error='Timeout or error')
+    except Exception as e:
+        return TestResult('background_own_process_group', False, error=str(e))
+    
+    if len(children) == 1 and groups[0] == children[0] and groups[0] != smash_group:
+        return TestResult('background_own_process_group', True)
+    return TestResult('background_own_process_group', False,
+                     expected='one child leading its own process group',
+                     actual='children {}, groups {}, smash group {}'.format(children, groups, smash_group))
+
 def test_fg_basic():
     """Test fg command"""
     # Start a background job, then bring to foreground
@@ -505,6 +1016,21 @@ def test_fg_basic():
         return TestResult('fg_basic', True)
     return TestResult('fg_basic', False, expected='fg to work', actual=combined)
 
+def test_fg_default_highest():
+    """Test fg without arguments picks the job with the highest ID"""
+    # If fg picked job 0 instead, this would block on sleep 100
+    stdout, stderr, code = run_smash(['sleep 100 &', 'sleep 1 &', 'fg', 'jobs', 'quit kill'], timeout=15)
+    if stdout is None:
+        return TestResult('fg_default_highest', False, error='Timeout or error')
+    
+    # After fg returns only job 0 is left; job 1 may only appear in fg's own output
+    listing = stdout.find('[0] sleep 100')
+    if listing != -1 and '[1]' not in stdout[listing:]:
+        return TestResult('fg_default_highest', True)
+    return TestResult('fg_default_highest', False,
+                     expected='only job 0 left after fg',
+                     actual=stdout)
+
 def test_fg_empty_list():
     """Test fg with empty job list"""
     stdout, stderr, code = run_smash(['fg', 'quit'])
@@ -523,6 +1049,39 @@ def test_bg_basic():
     # This is tricky to test without signals, skip for now
     return TestResult('bg_basic', True, error='Requires manual signal testing')
 
+def test_background_survives_ctrl_c():
+    """Test that CTRL+C sent to smash does not reach background jobs"""
+    try:
+        proc = subprocess.Popen(
+            [SMASH_PATH],
+            stdin=subprocess.PIPE,
+            stdout=subprocess.PIPE,
+            stderr=subprocess.PIPE,
+            universal_newlines=True,
+            preexec_fn=os.setpgrp  # own process group, like a terminal job
+        )
+        proc.stdin.write('sleep 100 &\n')
+        proc.stdin.flush()
+        time.sleep(0.5)
+        
+        # A terminal CTRL+C hits smash's whole process group; background
+        # jobs run in their own group and must not be affected
+        os.killpg(proc.pid, signal.SIGINT)
+        time.sleep(0.5)
+        
+        stdout, stderr = proc.communicate(input='jobs\nquit kill\n', timeout=10)
+    except subprocess.TimeoutExpired:
+        proc.kill()
+        return TestResult('background_survives_ctrl_c', False, error='Timeout or error')
+    except Exception as e:
+        return TestResult('background_survives_ctrl_c', False, error=str(e))
+    
+    if '[0] sleep' in stdout:
+        return TestResult('background_survives_ctrl_c', True)
+    return TestResult('background_survives_ctrl_c', False,
+                     expected='sleep job still listed after SIGINT',
+                     actual=stdout + stderr)
+
 def test_multiple_background_jobs():
     """Test multiple background jobs"""
     stdout, stderr, code = run_smash([
@@ -561,6 +1120,32 @@ def test_job_id_reuse():
         return TestResult('job_id_reuse', True)
     return TestResult('job_id_reuse', False, expected='jobs 0 and 1', actual=stdout)
 
+def test_job_id_lowest_free():
+    """Test that new jobs take the lowest free ID when there are several holes"""
+    stdout, stderr, code = run_smash([
+        'sleep 100 &',  # job 0
+        'sleep 100 &',  # job 1
+        'sleep 100 &',  # job 2
+        'sleep 100 &',  # job 3
+        'sleep 100 &',  # job 4
+        'kill 9 3',
+        'kill 9 1',
+        'sleep 1',      # let the killed jobs be reaped
+        'sleep 101 &',  # should get job 1
+        'sleep 103 &',  # should get job 3
+        'sleep 105 &',  # should get job 5
+        'jobs',
+        'quit kill'
+    ], timeout=30)
+    if stdout is None:
+        return TestResult('job_id_lowest_free', False, error='Timeout or error')
+    
+    if '[1] sleep 101' in stdout and '[3] sleep 103' in stdout and '[5] sleep 105' in stdout:
+        return TestResult('job_id_lowest_free', True)
+    return TestResult('job_id_lowest_free', False,
+                     expected='sleep 101/103/105 as jobs 1/3/5',
+                     actual=stdout)
+
 # ============================================================================
 # STRESS TESTS
 # ============================================================================
@@ -599,6 +1184,78 @@ def test_many_background_jobs():
                      expected='~20 jobs', 
                      actual='{} found'.format(job_count))
 
+def test_hundred_live_jobs():
+    """Test 100 background jobs that are all alive at the same time"""
+    commands = ['sleep 100 &' for _ in range(100)]
+    commands.append('jobs')
+    commands.append('quit kill')
+    
+    stdout, stderr, code = run_smash(commands, timeout=120)
+    if stdout is None:
+        return TestResult('hundred_live_jobs', False, error='Timeout or error')
+    
+    combined = stdout + stderr
+    list_full = 'full' in combined.lower()
+    if '[99] sleep' in stdout and not list_full:
+        return TestResult('hundred_live_jobs', True)
+    return TestResult('hundred_live_jobs', False,
+                     expected='jobs 0-99 listed without a full list error',
+                     actual='job list reported full' if list_full else 'job 99 missing')
+
+def test_kill_many_jobs():
+    """Test signalling many background jobs one kill command at a time"""
+    commands = ['sleep 100 &' for _ in range(20)]
+    commands.extend('kill 15 {}'.format(i) for i in range(20))
+    commands.append('sleep 1')  # let the killed jobs be reaped
+    commands.append('jobs')
+    commands.append('quit')
+    
+    stdout, stderr, code = run_smash(commands, timeout=60)
+    if stdout is None:
+        return TestResult('kill_many_jobs', False, error='Timeout or error')
+    
+    sent = stdout.count('signal 15 was sent to pid')
+    if sent == 20 and '] sleep' not in stdout:
+        return TestResult('kill_many_jobs', True)
+    return TestResult('kill_many_jobs', False,
+                     expected='20 signals and no jobs left',
+                     actual='{} signals, stdout: {}'.format(sent, stdout))
+
+def test_many_diff_commands():
+    """Test many diff commands report results in input order"""
+    with tempfile.NamedTemporaryFile(mode='w', delete=False) as f1:
+        f1.write('same\n')
+        file1 = f1.name
+    with tempfile.NamedTemporaryFile(mode='w', delete=False) as f2:
+        f2.write('same\n')
+        file2 = f2.name
+    with tempfile.NamedTemporaryFile(mode='w', delete=False) as f3:
+        f3.write('other\n')
+        file3 = f3.name
+    
+    try:
+        # Alternate equal and different pairs so any reordering shows up
+        commands = []
+        for i in range(200):
+            commands.append('diff {} {}'.format(file1, file2 if i % 2 == 0 else file3))
+        commands.append('quit')
+        
+        stdout, stderr, code = run_smash(commands, timeout=60)
+        if stdout is None:
+            return TestResult('many_diff_commands', False, error='Timeout or error')
+        
+        results = stdout.replace('smash > ', '\n').split()
+        expected = ['0', '1'] * 100
+        if results == expected:
+            return TestResult('many_diff_commands', True)
+        return TestResult('many_diff_commands', False,
+                         expected='200 alternating 0/1 results',
+                         actual='{} results'.format(len(results)))
+    finally:
+        os.unlink(file1)
+        os.unlink(file2)
+        os.unlink(file3)
+
 def test_rapid_cd():
     """Test rapid directory changes"""
     commands = []
@@ -734,6 +1391,26 @@ def test_garbage_collector_with_sleep():
     
     return TestResult('garbage_collector_sleep', True)
 
+def test_garbage_collector_while_busy():
+    """Test that jobs which finished while smash was busy are all collected"""
+    commands = ['sleep 1 &' for _ in range(30)]
+    
+    # A foreground sleep outlives every background job above
+    commands.append('sleep 2')
+    commands.append('jobs')
+    commands.append('quit')
+    
+    stdout, stderr, code = run_smash(commands, timeout=20)
+    if stdout is None:
+        return TestResult('garbage_collector_while_busy', False, error='Timeout or error')
+    
+    job_count = stdout.count('[')
+    if job_count == 0:
+        return TestResult('garbage_collector_while_busy', True)
+    return TestResult('garbage_collector_while_busy', False,
+                     expected='no jobs left',
+                     actual='{} found'.format(job_count))
+
 # ============================================================================
 # MAIN TEST RUNNER
 # ============================================================================
@@ -767,27 +1444,45 @@ def run_all_tests():
         # jobs tests
         test_jobs_empty,
         test_jobs_with_background,
+        test_jobs_listing_order,
+        test_jobs_mixed_commands,
         
         # kill tests
         test_kill_job,
         test_kill_nonexistent,
+        test_kill_finished_job,
         test_kill_invalid_args,
         
         # diff tests
         test_diff_same_files,
         test_diff_different_files,
+        test_diff_empty_files,
+        test_diff_multiline_output,
+        test_diff_large_files,
+        test_diff_large_range_boundaries,
+        test_diff_shared_prefix,
+        test_diff_size_mismatch,
+        test_diff_same_inode,
+        test_diff_sparse_files,
+        test_diff_after_rewrite,
+        test_diff_after_rewrite_between_runs,
         test_diff_nonexistent,
         test_diff_directory,
+        test_diff_file_and_directory,
         test_diff_wrong_args,
         
         # quit tests
         test_quit,
         test_quit_kill,
+        test_quit_kill_many_jobs,
         test_quit_invalid_arg,
         
         # external command tests
         test_external_ls,
         test_external_echo,
+        test_external_cwd,
+        test_external_lookup_repeated,
+        test_whitespace_between_args,
         test_external_background,
         
         # alias tests
@@ -799,21 +1494,31 @@ def run_all_tests():
     system_tests = [
         test_complex_command_success,
         test_complex_command_fail,
+        test_true_false_chain,
+        test_external_status_chain,
         test_fg_basic,
+        test_fg_default_highest,
         test_fg_empty_list,
         test_bg_basic,
+        test_background_survives_ctrl_c,
+        test_background_own_process_group,
         test_multiple_background_jobs,
         test_job_id_reuse,
+        test_job_id_lowest_free,
     ]
     
     stress_tests = [
         test_many_commands,
         test_many_background_jobs,
+        test_hundred_live_jobs,
+        test_kill_many_jobs,
+        test_many_diff_commands,
         test_rapid_cd,
         test_alias_chain,
         test_alias_recursive,
         test_garbage_collector,
         test_garbage_collector_with_sleep,
+        test_garbage_collector_while_busy,
     ]
     
     all_tests = [
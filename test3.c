@@ -154,6 +154,24 @@ int test_kill_nonexistent() {
     }
 }
 
+int test_kill_finished_job() {
+    printf("Test: kill a job that already exited\n");
+    char output[BUFFER_SIZE];
+    const char* commands[] = {"sleep 1 &", "sleep 2", "kill 9 0", "quit"};
+    
+    run_smash_commands(commands, 4, output, BUFFER_SIZE, 10);
+    
+    // The job is gone, so no signal may be sent to its (reusable) pid
+    if (strstr(output, "job id 0 does not exist") != NULL &&
+        strstr(output, "was sent to pid") == NULL) {
+        printf("  PASSED: kill refuses a finished job\n");
+        return 0;
+    } else {
+        printf("  FAILED: Expected 'job id 0 does not exist', got: %s\n", output);
+        return 1;
+    }
+}
+
 int test_kill_invalid_args() {
     printf("Test: kill with invalid arguments\n");
     char output[BUFFER_SIZE];
@@ -186,6 +204,25 @@ int test_fg_empty_list() {
     }
 }
 
+int test_fg_default_highest() {
+    printf("Test: fg without arguments picks the highest job ID\n");
+    char output[BUFFER_SIZE];
+    // If fg picked job 0 instead, this would block on sleep 100
+    const char* commands[] = {"sleep 100 &", "sleep 1 &", "fg", "jobs", "quit kill"};
+    
+    run_smash_commands(commands, 5, output, BUFFER_SIZE, 15);
+    
+    // After fg returns only job 0 is left; job 1 may only appear in fg's own output
+    char* listing = strstr(output, "[0] sleep 100");
+    if (listing != NULL && strstr(listing, "[1]") == NULL) {
+        printf("  PASSED: fg brought job 1 to the foreground\n");
+        return 0;
+    } else {
+        printf("  FAILED: Expected only job 0 left after fg, got: %s\n", output);
+        return 1;
+    }
+}
+
 int test_fg_nonexistent() {
     printf("Test: fg nonexistent job\n");
     char output[BUFFER_SIZE];
@@ -235,6 +272,94 @@ int test_multiple_background() {
     }
 }
 
+int test_jobs_listing_order() {
+    printf("Test: jobs lists entries in job ID order\n");
+    char output[BUFFER_SIZE];
+    const char* commands[] = {
+        "sleep 100 &",  // Job 0
+        "sleep 101 &",  // Job 1
+        "sleep 102 &",  // Job 2
+        "kill 9 0",
+        "sleep 1",      // Let job 0 be reaped
+        "sleep 103 &",  // Refills job 0, inserted last
+        "jobs",
+        "quit kill"
+    };
+    
+    run_smash_commands(commands, 8, output, BUFFER_SIZE, 20);
+    
+    // Every entry is "[id] command: ...", sorted by id regardless of insertion order
+    char* p0 = strstr(output, "[0] sleep 103");
+    char* p1 = strstr(output, "[1] sleep 101");
+    char* p2 = strstr(output, "[2] sleep 102");
+    if (p0 != NULL && p1 != NULL && p2 != NULL && p0 < p1 && p1 < p2 &&
+        strchr(p0, ':') != NULL && strchr(p0, ':') < p1) {
+        printf("  PASSED: jobs sorted by ID\n");
+        return 0;
+    } else {
+        printf("  FAILED: Expected jobs 0, 1, 2 in order, got: %s\n", output);
+        return 1;
+    }
+}
+
+int test_jobs_mixed_commands() {
+    printf("Test: jobs keeps each command line with its arguments\n");
+    char output[BUFFER_SIZE];
+    const char* commands[] = {
+        "sleep 100 &",
+        "tail -f /dev/null &",
+        "sleep 200 &",
+        "jobs",
+        "quit kill"
+    };
+    
+    run_smash_commands(commands, 5, output, BUFFER_SIZE, 20);
+    
+    if (strstr(output, "[0] sleep 100") != NULL &&
+        strstr(output, "[1] tail -f /dev/null") != NULL &&
+        strstr(output, "[2] sleep 200") != NULL) {
+        printf("  PASSED: jobs shows every command line\n");
+        return 0;
+    } else {
+        printf("  FAILED: Expected sleep, tail and sleep jobs, got: %s\n", output);
+        return 1;
+    }
+}
+
+int test_garbage_collector_while_busy() {
+    printf("Test: garbage collector removes jobs that exit while smash is busy\n");
+    char output[BUFFER_SIZE];
+    
+    const char* commands[33];
+    for (int i = 0; i < 30; i++) {
+        commands[i] = "sleep 1 &";
+    }
+    commands[30] = "sleep 2";  // Foreground: every job above exits meanwhile
+    commands[31] = "jobs";
+    commands[32] = "quit";
+    
+    run_smash_commands(commands, 33, output, BUFFER_SIZE, 20);
+    
+    // Count job entries (lines starting with [)
+    int job_count = 0;
+    char* p = output;
+    while ((p = strchr(p, '[')) != NULL) {
+        char* bracket = strchr(p, ']');
+        if (bracket && strchr(bracket, ':')) {
+            job_count++;
+        }
+        p++;
+    }
+    
+    if (job_count == 0) {
+        printf("  PASSED: all finished jobs were removed\n");
+        return 0;
+    } else {
+        printf("  FAILED: Expected empty list, found %d jobs: %s\n", job_count, output);
+        return 1;
+    }
+}
+
 int main() {
     printf("=== Test 3: Jobs Management Tests ===\n\n");
     
@@ -244,10 +369,15 @@ int main() {
     failures += test_jobs_with_background();
     failures += test_kill_job();
     failures += test_kill_nonexistent();
+    failures += test_kill_finished_job();
     failures += test_kill_invalid_args();
     failures += test_fg_empty_list();
+    failures += test_fg_default_highest();
     failures += test_fg_nonexistent();
     failures += test_multiple_background();
+    failures += test_jobs_listing_order();
+    failures += test_jobs_mixed_commands();
+    failures += test_garbage_collector_while_busy();
     
     printf("\n=== Results: %d tests failed ===\n", failures);
     return failures > 0 ? 1 : 0;
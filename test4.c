@@ -84,6 +84,71 @@ void create_test_file(const char* path, const char* content) {
     }
 }
 
+void create_pattern_file(const char* path, size_t size, long flip_offset) {
+    int fd = open(path, O_CREAT | O_WRONLY | O_TRUNC, 0644);
+    if (fd < 0) {
+        return;
+    }
+    
+    char chunk[BUFFER_SIZE];
+    size_t written = 0;
+    while (written < size) {
+        size_t len = size - written < sizeof(chunk) ? size - written : sizeof(chunk);
+        for (size_t i = 0; i < len; i++) {
+            size_t pos = written + i;
+            chunk[i] = (char)((pos * 31 + 7) & 0xff);
+            if (flip_offset >= 0 && pos == (size_t)flip_offset) {
+                chunk[i] ^= 0xff;
+            }
+        }
+        write(fd, chunk, len);
+        written += len;
+    }
+    close(fd);
+}
+
+// Writes "data" at data_offset inside a file of the given size; the rest is
+// a hole unless dense is set, in which case the zeros are written out
+void create_sparse_file(const char* path, size_t size, off_t data_offset, const char* data, int dense) {
+    int fd = open(path, O_CREAT | O_WRONLY | O_TRUNC, 0644);
+    if (fd < 0) {
+        return;
+    }
+    
+    if (dense) {
+        char zeros[BUFFER_SIZE];
+        memset(zeros, 0, sizeof(zeros));
+        size_t written = 0;
+        while (written < size) {
+            size_t len = size - written < sizeof(zeros) ? size - written : sizeof(zeros);
+            write(fd, zeros, len);
+            written += len;
+        }
+    }
+    pwrite(fd, data, strlen(data), data_offset);
+    ftruncate(fd, size);
+    close(fd);
+}
+
+// Collects the 0/1 results printed right after each prompt, returns their count
+int collect_diff_results(const char* output, int results[], int max_results) {
+    int count = 0;
+    const char* p = output;
+    while (count < max_results && (p = strstr(p, "smash > ")) != NULL) {
+        p += strlen("smash > ");
+        if ((p[0] == '0' || p[0] == '1') && p[1] == '\n') {
+            results[count++] = p[0] - '0';
+        }
+    }
+    return count;
+}
+
+// Returns the first diff result smash printed, or -1 if there is none
+int parse_diff_result(const char* output) {
+    int result;
+    return collect_diff_results(output, &result, 1) == 1 ? result : -1;
+}
+
 int test_diff_same_files() {
     printf("Test: diff with identical files\n");
     char output[BUFFER_SIZE];
@@ -146,6 +211,390 @@ int test_diff_different_files() {
     return 1;
 }
 
+int test_diff_empty_files() {
+    printf("Test: diff with empty files\n");
+    char output[BUFFER_SIZE];
+    
+    const char* file1 = "/tmp/smash_test_diff1";
+    const char* file2 = "/tmp/smash_test_diff2";
+    const char* file3 = "/tmp/smash_test_diff3";
+    
+    create_test_file(file1, "");
+    create_test_file(file2, "");
+    create_test_file(file3, "x");
+    
+    // The empty file must compare unequal whichever side reaches EOF first
+    char cmd1[256], cmd2[256], cmd3[256];
+    snprintf(cmd1, sizeof(cmd1), "diff %s %s", file1, file2);
+    snprintf(cmd2, sizeof(cmd2), "diff %s %s", file1, file3);
+    snprintf(cmd3, sizeof(cmd3), "diff %s %s", file3, file1);
+    const char* commands[] = {cmd1, cmd2, cmd3, "quit"};
+    
+    run_smash_commands(commands, 4, output, BUFFER_SIZE, 5);
+    
+    unlink(file1);
+    unlink(file2);
+    unlink(file3);
+    
+    int results[4];
+    int count = collect_diff_results(output, results, 4);
+    
+    if (count == 3 && results[0] == 0 && results[1] == 1 && results[2] == 1) {
+        printf("  PASSED: diff handles empty files\n");
+        return 0;
+    }
+    printf("  FAILED: Expected 0, 1, 1, got: %s\n", output);
+    return 1;
+}
+
+int test_diff_multiline_output() {
+    printf("Test: diff prints only 0/1 for multi-line files\n");
+    char output[BUFFER_SIZE];
+    
+    const char* file1 = "/tmp/smash_test_diff1";
+    const char* file2 = "/tmp/smash_test_diff2";
+    const char* file3 = "/tmp/smash_test_diff3";
+    
+    create_test_file(file1, "alpha\nbeta\ngamma\ndelta\n");
+    // One line changed in the middle
+    create_test_file(file2, "alpha\nbeta\nGAMMA\ndelta\n");
+    // Same lines, missing the trailing newline
+    create_test_file(file3, "alpha\nbeta\ngamma\ndelta");
+    
+    char cmd1[256], cmd2[256];
+    snprintf(cmd1, sizeof(cmd1), "diff %s %s", file1, file2);
+    snprintf(cmd2, sizeof(cmd2), "diff %s %s", file1, file3);
+    const char* commands[] = {cmd1, cmd2, "quit"};
+    
+    run_smash_commands(commands, 3, output, BUFFER_SIZE, 5);
+    
+    unlink(file1);
+    unlink(file2);
+    unlink(file3);
+    
+    // Each result must be a bare line, with no hunks before the next prompt
+    char* first = strstr(output, "smash > 1\nsmash > ");
+    if (first != NULL && strstr(first + 1, "smash > 1\nsmash > ") != NULL) {
+        printf("  PASSED: diff prints a bare 1 for each pair\n");
+        return 0;
+    }
+    printf("  FAILED: Expected two bare 1 results, got: %s\n", output);
+    return 1;
+}
+
+int test_diff_large_same_files() {
+    printf("Test: diff with large identical files\n");
+    char output[BUFFER_SIZE];
+    
+    const char* file1 = "/tmp/smash_test_diff_large1";
+    const char* file2 = "/tmp/smash_test_diff_large2";
+    
+    // 8 MiB plus an odd tail so the size is not a multiple of any block width
+    size_t size = 8 * 1024 * 1024 + 13;
+    create_pattern_file(file1, size, -1);
+    create_pattern_file(file2, size, -1);
+    
+    char cmd[256];
+    snprintf(cmd, sizeof(cmd), "diff %s %s", file1, file2);
+    const char* commands[] = {cmd, "quit"};
+    
+    run_smash_commands(commands, 2, output, BUFFER_SIZE, 30);
+    
+    unlink(file1);
+    unlink(file2);
+    
+    if (parse_diff_result(output) == 0) {
+        printf("  PASSED: diff returns 0 for large identical files\n");
+        return 0;
+    }
+    printf("  FAILED: Expected 0, got: %s\n", output);
+    return 1;
+}
+
+int test_diff_large_last_byte() {
+    printf("Test: diff with large files differing in the last byte\n");
+    char output[BUFFER_SIZE];
+    
+    const char* file1 = "/tmp/smash_test_diff_large1";
+    const char* file2 = "/tmp/smash_test_diff_large2";
+    
+    size_t size = 8 * 1024 * 1024 + 13;
+    create_pattern_file(file1, size, -1);
+    create_pattern_file(file2, size, (long)size - 1);
+    
+    char cmd[256];
+    snprintf(cmd, sizeof(cmd), "diff %s %s", file1, file2);
+    const char* commands[] = {cmd, "quit"};
+    
+    run_smash_commands(commands, 2, output, BUFFER_SIZE, 30);
+    
+    unlink(file1);
+    unlink(file2);
+    
+    // The differing byte sits in the unaligned tail after the last full block
+    if (parse_diff_result(output) == 1) {
+        printf("  PASSED: diff returns 1 when only the last byte differs\n");
+        return 0;
+    }
+    printf("  FAILED: Expected 1, got: %s\n", output);
+    return 1;
+}
+
+int test_diff_large_range_boundaries() {
+    printf("Test: diff with large files differing around range boundaries\n");
+    char output[BUFFER_SIZE];
+    
+    const char* file1 = "/tmp/smash_test_diff_large1";
+    const char* file2 = "/tmp/smash_test_diff_large2";
+    const char* file3 = "/tmp/smash_test_diff_large3";
+    const char* file4 = "/tmp/smash_test_diff_large4";
+    
+    // Differences at the first byte and on either side of the 16 MiB mark,
+    // where a range-partitioned compare would split the work
+    size_t size = 32 * 1024 * 1024 + 1;
+    long boundary = 16 * 1024 * 1024;
+    create_pattern_file(file1, size, -1);
+    create_pattern_file(file2, size, 0);
+    create_pattern_file(file3, size, boundary - 1);
+    create_pattern_file(file4, size, boundary);
+    
+    char cmd1[256], cmd2[256], cmd3[256];
+    snprintf(cmd1, sizeof(cmd1), "diff %s %s", file1, file2);
+    snprintf(cmd2, sizeof(cmd2), "diff %s %s", file1, file3);
+    snprintf(cmd3, sizeof(cmd3), "diff %s %s", file1, file4);
+    const char* commands[] = {cmd1, cmd2, cmd3, "quit"};
+    
+    run_smash_commands(commands, 4, output, BUFFER_SIZE, 60);
+    
+    unlink(file1);
+    unlink(file2);
+    unlink(file3);
+    unlink(file4);
+    
+    int results[4];
+    int count = collect_diff_results(output, results, 4);
+    
+    if (count == 3 && results[0] == 1 && results[1] == 1 && results[2] == 1) {
+        printf("  PASSED: diff returns 1 for every range boundary case\n");
+        return 0;
+    }
+    printf("  FAILED: Expected three 1 results, got: %s\n", output);
+    return 1;
+}
+
+int test_diff_shared_prefix() {
+    printf("Test: diff with files sharing their first 4 KiB\n");
+    char output[BUFFER_SIZE];
+    
+    const char* file1 = "/tmp/smash_test_diff1";
+    const char* file2 = "/tmp/smash_test_diff2";
+    const char* file3 = "/tmp/smash_test_diff3";
+    
+    // One difference just inside and one just past a 4 KiB prefix
+    create_pattern_file(file1, 65536, -1);
+    create_pattern_file(file2, 65536, 4095);
+    create_pattern_file(file3, 65536, 4096);
+    
+    char cmd1[256], cmd2[256];
+    snprintf(cmd1, sizeof(cmd1), "diff %s %s", file1, file2);
+    snprintf(cmd2, sizeof(cmd2), "diff %s %s", file1, file3);
+    const char* commands[] = {cmd1, cmd2, "quit"};
+    
+    run_smash_commands(commands, 3, output, BUFFER_SIZE, 5);
+    
+    unlink(file1);
+    unlink(file2);
+    unlink(file3);
+    
+    int results[3];
+    int count = collect_diff_results(output, results, 3);
+    
+    if (count == 2 && results[0] == 1 && results[1] == 1) {
+        printf("  PASSED: diff looks past a shared prefix\n");
+        return 0;
+    }
+    printf("  FAILED: Expected 1 twice, got: %s\n", output);
+    return 1;
+}
+
+int test_diff_size_mismatch() {
+    printf("Test: diff with files of different sizes\n");
+    char output[BUFFER_SIZE];
+    
+    const char* file1 = "/tmp/smash_test_diff1";
+    const char* file2 = "/tmp/smash_test_diff2";
+    
+    // file2 is file1 plus one trailing byte, so the common prefix is equal
+    create_pattern_file(file1, 100000, -1);
+    create_pattern_file(file2, 100001, -1);
+    
+    char cmd[256];
+    snprintf(cmd, sizeof(cmd), "diff %s %s", file1, file2);
+    const char* commands[] = {cmd, "quit"};
+    
+    run_smash_commands(commands, 2, output, BUFFER_SIZE, 5);
+    
+    unlink(file1);
+    unlink(file2);
+    
+    if (parse_diff_result(output) == 1) {
+        printf("  PASSED: diff returns 1 for files of different sizes\n");
+        return 0;
+    }
+    printf("  FAILED: Expected 1, got: %s\n", output);
+    return 1;
+}
+
+int test_diff_same_inode() {
+    printf("Test: diff with paths to the same inode\n");
+    char output[BUFFER_SIZE];
+    
+    const char* file1 = "/tmp/smash_test_diff1";
+    const char* hardlink = "/tmp/smash_test_diff_hardlink";
+    const char* symlink_path = "/tmp/smash_test_diff_symlink";
+    
+    create_test_file(file1, "shared content\n");
+    unlink(hardlink);
+    unlink(symlink_path);
+    link(file1, hardlink);
+    symlink(file1, symlink_path);
+    
+    char cmd1[256], cmd2[256], cmd3[256];
+    snprintf(cmd1, sizeof(cmd1), "diff %s %s", file1, file1);
+    snprintf(cmd2, sizeof(cmd2), "diff %s %s", file1, hardlink);
+    snprintf(cmd3, sizeof(cmd3), "diff %s %s", symlink_path, file1);
+    const char* commands[] = {cmd1, cmd2, cmd3, "quit"};
+    
+    run_smash_commands(commands, 4, output, BUFFER_SIZE, 5);
+    
+    unlink(symlink_path);
+    unlink(hardlink);
+    unlink(file1);
+    
+    int results[4];
+    int count = collect_diff_results(output, results, 4);
+    
+    if (count == 3 && results[0] == 0 && results[1] == 0 && results[2] == 0) {
+        printf("  PASSED: diff returns 0 for self, hardlink and symlink\n");
+        return 0;
+    }
+    printf("  FAILED: Expected three 0 results, got: %s\n", output);
+    return 1;
+}
+
+int test_diff_sparse_files() {
+    printf("Test: diff with sparse files\n");
+    char output[BUFFER_SIZE];
+    
+    const char* file1 = "/tmp/smash_test_diff_sparse1";
+    const char* file2 = "/tmp/smash_test_diff_sparse2";
+    const char* file3 = "/tmp/smash_test_diff_sparse3";
+    const char* file4 = "/tmp/smash_test_diff_sparse4";
+    
+    size_t size = 16 * 1024 * 1024;
+    off_t offset = 4 * 1024 * 1024;
+    create_sparse_file(file1, size, offset, "sparse data", 0);
+    create_sparse_file(file2, size, offset, "sparse data", 0);
+    // Same bytes as file1 but with the zeros actually written
+    create_sparse_file(file3, size, offset, "sparse data", 1);
+    // Same size, data moved to another offset
+    create_sparse_file(file4, size, offset * 2, "sparse data", 0);
+    
+    char cmd1[256], cmd2[256], cmd3[256];
+    snprintf(cmd1, sizeof(cmd1), "diff %s %s", file1, file2);
+    snprintf(cmd2, sizeof(cmd2), "diff %s %s", file1, file3);
+    snprintf(cmd3, sizeof(cmd3), "diff %s %s", file1, file4);
+    const char* commands[] = {cmd1, cmd2, cmd3, "quit"};
+    
+    run_smash_commands(commands, 4, output, BUFFER_SIZE, 30);
+    
+    unlink(file1);
+    unlink(file2);
+    unlink(file3);
+    unlink(file4);
+    
+    int results[4];
+    int count = collect_diff_results(output, results, 4);
+    
+    if (count == 3 && results[0] == 0 && results[1] == 0 && results[2] == 1) {
+        printf("  PASSED: diff compares sparse files by content\n");
+        return 0;
+    }
+    printf("  FAILED: Expected 0, 0, 1, got: %s\n", output);
+    return 1;
+}
+
+int test_diff_after_rewrite() {
+    printf("Test: diff after a file is rewritten in place\n");
+    char output[BUFFER_SIZE];
+    
+    const char* file1 = "/tmp/smash_test_diff1";
+    const char* file2 = "/tmp/smash_test_diff2";
+    const char* file3 = "/tmp/smash_test_diff3";
+    
+    // file3 has the same size as file2 but different content
+    create_test_file(file1, "same size content A\n");
+    create_test_file(file2, "same size content A\n");
+    create_test_file(file3, "same size content B\n");
+    
+    // cp onto an existing file keeps its inode and size, so only the
+    // content (and mtime) changes between the two diffs
+    char diff_cmd[256], cp_cmd[256];
+    snprintf(diff_cmd, sizeof(diff_cmd), "diff %s %s", file1, file2);
+    snprintf(cp_cmd, sizeof(cp_cmd), "cp %s %s", file3, file1);
+    const char* commands[] = {diff_cmd, cp_cmd, diff_cmd, "quit"};
+    
+    run_smash_commands(commands, 4, output, BUFFER_SIZE, 5);
+    
+    unlink(file1);
+    unlink(file2);
+    unlink(file3);
+    
+    int results[4];
+    int count = collect_diff_results(output, results, 4);
+    
+    if (count == 2 && results[0] == 0 && results[1] == 1) {
+        printf("  PASSED: diff sees the rewritten content\n");
+        return 0;
+    }
+    printf("  FAILED: Expected 0 then 1, got: %s\n", output);
+    return 1;
+}
+
+int test_diff_after_rewrite_between_runs() {
+    printf("Test: diff after a file is rewritten between two smash runs\n");
+    char output1[BUFFER_SIZE];
+    char output2[BUFFER_SIZE];
+    
+    const char* file1 = "/tmp/smash_test_diff1";
+    const char* file2 = "/tmp/smash_test_diff2";
+    
+    create_test_file(file1, "same size content A\n");
+    create_test_file(file2, "same size content A\n");
+    
+    char cmd[256];
+    snprintf(cmd, sizeof(cmd), "diff %s %s", file1, file2);
+    const char* commands[] = {cmd, "quit"};
+    
+    run_smash_commands(commands, 2, output1, BUFFER_SIZE, 5);
+    
+    // Rewriting through the existing path keeps the inode and the size,
+    // so anything remembered from the first run must not be trusted
+    create_test_file(file1, "same size content B\n");
+    
+    run_smash_commands(commands, 2, output2, BUFFER_SIZE, 5);
+    
+    unlink(file1);
+    unlink(file2);
+    
+    if (parse_diff_result(output1) == 0 && parse_diff_result(output2) == 1) {
+        printf("  PASSED: diff sees content rewritten between runs\n");
+        return 0;
+    }
+    printf("  FAILED: Expected 0 then 1, got: %s / %s\n", output1, output2);
+    return 1;
+}
+
 int test_diff_nonexistent() {
     printf("Test: diff with nonexistent file\n");
     char output[BUFFER_SIZE];
@@ -176,6 +625,32 @@ int test_diff_directory() {
     return 1;
 }
 
+int test_diff_file_and_directory() {
+    printf("Test: diff with a file and a directory\n");
+    char output[BUFFER_SIZE];
+    
+    const char* file1 = "/tmp/smash_test_diff1";
+    create_test_file(file1, "content\n");
+    
+    char cmd1[256], cmd2[256];
+    snprintf(cmd1, sizeof(cmd1), "diff %s /tmp", file1);
+    snprintf(cmd2, sizeof(cmd2), "diff /tmp %s", file1);
+    const char* commands[] = {cmd1, cmd2, "quit"};
+    
+    run_smash_commands(commands, 3, output, BUFFER_SIZE, 5);
+    
+    unlink(file1);
+    
+    // Both argument orders must be rejected
+    char* first = strstr(output, "paths are not files");
+    if (first != NULL && strstr(first + 1, "paths are not files") != NULL) {
+        printf("  PASSED: diff rejects a file/directory pair\n");
+        return 0;
+    }
+    printf("  FAILED: Expected 'paths are not files' twice, got: %s\n", output);
+    return 1;
+}
+
 int test_diff_wrong_args() {
     printf("Test: diff with wrong number of arguments\n");
     char output[BUFFER_SIZE];
@@ -221,6 +696,45 @@ int test_quit_kill() {
     return 1;
 }
 
+int test_quit_kill_many_jobs() {
+    printf("Test: quit kill reports every job in order\n");
+    char output[BUFFER_SIZE];
+    const char* commands[11];
+    for (int i = 0; i < 10; i++) {
+        commands[i] = "sleep 100 &";
+    }
+    commands[10] = "quit kill";
+    
+    int exit_code = run_smash_commands(commands, 11, output, BUFFER_SIZE, 15);
+    
+    // Each job gets its own SIGTERM line, in increasing job ID order
+    int in_order = 1;
+    char* p = output;
+    for (int i = 0; i < 10 && in_order; i++) {
+        char tag[16];
+        snprintf(tag, sizeof(tag), "[%d] ", i);
+        p = strstr(p, tag);
+        if (p == NULL) {
+            in_order = 0;
+            break;
+        }
+        // SIGTERM must be on this job's own line
+        char* sigterm = strstr(p, "SIGTERM");
+        char* line_end = strchr(p, '\n');
+        if (sigterm == NULL || (line_end != NULL && sigterm > line_end)) {
+            in_order = 0;
+        }
+        p += strlen(tag);
+    }
+    
+    if (in_order && exit_code == 0) {
+        printf("  PASSED: quit kill reports jobs 0-9 in order\n");
+        return 0;
+    }
+    printf("  FAILED: Expected SIGTERM lines for jobs 0-9 in order, got: %s\n", output);
+    return 1;
+}
+
 int test_quit_invalid_arg() {
     printf("Test: quit with invalid argument\n");
     char output[BUFFER_SIZE];
@@ -243,11 +757,24 @@ int main() {
     
     failures += test_diff_same_files();
     failures += test_diff_different_files();
+    failures += test_diff_empty_files();
+    failures += test_diff_multiline_output();
+    failures += test_diff_large_same_files();
+    failures += test_diff_large_last_byte();
+    failures += test_diff_large_range_boundaries();
+    failures += test_diff_shared_prefix();
+    failures += test_diff_size_mismatch();
+    failures += test_diff_same_inode();
+    failures += test_diff_sparse_files();
+    failures += test_diff_after_rewrite();
+    failures += test_diff_after_rewrite_between_runs();
     failures += test_diff_nonexistent();
     failures += test_diff_directory();
+    failures += test_diff_file_and_directory();
     failures += test_diff_wrong_args();
     failures += test_quit_basic();
     failures += test_quit_kill();
+    failures += test_quit_kill_many_jobs();
     failures += test_quit_invalid_arg();
     
     printf("\n=== Results: %d tests failed ===\n", failures);
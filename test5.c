@@ -113,6 +113,24 @@ int test_external_ls() {
     return 1;
 }
 
+int test_external_cwd() {
+    printf("Test: external command runs in the current directory\n");
+    char output[BUFFER_SIZE];
+    // /bin/pwd is the external binary, not the pwd built-in
+    const char* commands[] = {"cd /tmp", "/bin/pwd", "cd /var", "/bin/pwd", "quit"};
+    
+    run_smash_commands(commands, 5, output, BUFFER_SIZE, 5);
+    
+    // Each /bin/pwd must print exactly the directory of the cd before it
+    char* first = strstr(output, "smash > /tmp\n");
+    if (first != NULL && strstr(first, "smash > /var\n") != NULL) {
+        printf("  PASSED: external command follows cd\n");
+        return 0;
+    }
+    printf("  FAILED: Expected /tmp then /var, got: %s\n", output);
+    return 1;
+}
+
 int test_external_background() {
     printf("Test: external command in background\n");
     char output[BUFFER_SIZE];
@@ -229,6 +247,7 @@ int main() {
     
     failures += test_external_echo();
     failures += test_external_ls();
+    failures += test_external_cwd();
     failures += test_external_background();
     failures += test_alias_basic();
     failures += test_alias_list();
@@ -8,6 +8,7 @@
 #include <string.h>
 #include <unistd.h>
 #include <sys/wait.h>
+#include <fcntl.h>
 #include <time.h>
 
 #define BUFFER_SIZE 65536
@@ -143,6 +144,66 @@ int test_many_background_jobs() {
     return 1;
 }
 
+int test_hundred_live_jobs() {
+    printf("Test: 100 live background jobs\n");
+    char output[BUFFER_SIZE];
+    
+    const char* commands[103];
+    for (int i = 0; i < 100; i++) {
+        commands[i] = "sleep 100 &";
+    }
+    commands[100] = "jobs";
+    commands[101] = "quit kill";
+    commands[102] = NULL;
+    
+    run_smash_commands_large(commands, 102, output, BUFFER_SIZE, 120);
+    
+    // Every job is still running, so all 100 must hold an ID at once
+    int has_last = strstr(output, "[99] sleep") != NULL;
+    int list_full = strstr(output, "full") != NULL;
+    if (has_last && !list_full) {
+        printf("  PASSED: 100 live background jobs handled\n");
+        return 0;
+    }
+    printf("  FAILED: Expected jobs 0-99 without a full list (%s)\n",
+           list_full ? "job list reported full" : "job 99 missing");
+    return 1;
+}
+
+int test_kill_many_jobs() {
+    printf("Test: kill 20 background jobs one by one\n");
+    char output[BUFFER_SIZE];
+    
+    char kill_cmds[20][32];
+    const char* commands[44];
+    for (int i = 0; i < 20; i++) {
+        commands[i] = "sleep 100 &";
+        snprintf(kill_cmds[i], sizeof(kill_cmds[i]), "kill 15 %d", i);
+        commands[20 + i] = kill_cmds[i];
+    }
+    commands[40] = "sleep 1";  // Let the killed jobs be reaped
+    commands[41] = "jobs";
+    commands[42] = "quit";
+    commands[43] = NULL;
+    
+    run_smash_commands_large(commands, 43, output, BUFFER_SIZE, 60);
+    
+    int sent = 0;
+    char* p = output;
+    while ((p = strstr(p, "signal 15 was sent to pid")) != NULL) {
+        sent++;
+        p++;
+    }
+    
+    // Every job was signalled, so the final listing must be empty
+    if (sent == 20 && strstr(output, "] sleep") == NULL) {
+        printf("  PASSED: %d jobs signalled and removed\n", sent);
+        return 0;
+    }
+    printf("  FAILED: Expected 20 signals and no jobs left, got %d signals\n", sent);
+    return 1;
+}
+
 int test_rapid_cd_changes() {
     printf("Test: 50 rapid directory changes\n");
     char output[BUFFER_SIZE];
@@ -194,6 +255,39 @@ int test_job_id_recycling() {
     return 1;
 }
 
+int test_job_id_lowest_free() {
+    printf("Test: Job IDs fill the lowest free slot first\n");
+    char output[BUFFER_SIZE];
+    
+    const char* commands[] = {
+        "sleep 100 &",  // Job 0
+        "sleep 100 &",  // Job 1
+        "sleep 100 &",  // Job 2
+        "sleep 100 &",  // Job 3
+        "sleep 100 &",  // Job 4
+        "kill 9 3",
+        "kill 9 1",
+        "sleep 1",      // Let the killed jobs be reaped
+        "sleep 101 &",  // Should get job 1
+        "sleep 103 &",  // Should get job 3
+        "sleep 105 &",  // Should get job 5
+        "jobs",
+        "quit kill"
+    };
+    
+    run_smash_commands_large(commands, 13, output, BUFFER_SIZE, 30);
+    
+    if (strstr(output, "[1] sleep 101") != NULL &&
+        strstr(output, "[3] sleep 103") != NULL &&
+        strstr(output, "[5] sleep 105") != NULL) {
+        printf("  PASSED: Freed IDs are reused lowest first\n");
+        return 0;
+    }
+    printf("  FAILED: Expected jobs 1, 3 and 5 to be refilled in order\n");
+    printf("  Output: %s\n", output);
+    return 1;
+}
+
 int test_long_command_line() {
     printf("Test: Long command with many arguments\n");
     char output[BUFFER_SIZE];
@@ -220,6 +314,138 @@ int test_long_command_line() {
     return 1;
 }
 
+// Fastest of three runs, to keep scheduler noise out of the timings
+double time_smash_commands(const char* commands[], int num_commands, char* output, size_t output_size) {
+    double best = -1;
+    for (int run = 0; run < 3; run++) {
+        struct timespec start, end;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        run_smash_commands_large(commands, num_commands, output, output_size, 60);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        
+        double elapsed = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+        if (best < 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+    return best;
+}
+
+int test_long_line_scaling() {
+    printf("Test: Parse time of lines from 1 KB to 1 MB\n");
+    char output[BUFFER_SIZE];
+    
+    size_t sizes[] = {1024, 8 * 1024, 64 * 1024, 1024 * 1024};
+    size_t first_failed = 0;
+    
+    // Fork, exec, startup and quit are paid by every run; subtract them so
+    // the figures below are the cost of reading and parsing the line
+    const char* baseline_commands[] = {"quit"};
+    double baseline = time_smash_commands(baseline_commands, 1, output, BUFFER_SIZE);
+    printf("  startup baseline: %.3fs\n", baseline);
+    
+    for (int i = 0; i < 4; i++) {
+        // showpid tokenizes the whole line and rejects it without forking,
+        // so the time is spent reading and parsing rather than in execve
+        char* line = malloc(sizes[i] + 32);
+        if (line == NULL) {
+            printf("  FAILED: out of memory\n");
+            return 1;
+        }
+        
+        size_t len = (size_t)sprintf(line, "showpid");
+        for (int arg = 0; len < sizes[i] - 16; arg++) {
+            len += (size_t)sprintf(line + len, " a%07d", arg);
+        }
+        
+        const char* commands[] = {line, "quit"};
+        
+        double time_spent = time_smash_commands(commands, 2, output, BUFFER_SIZE) - baseline;
+        if (time_spent < 0) {
+            time_spent = 0;
+        }
+        
+        // Exactly one error: a truncated line would spill into extra commands
+        int error_count = 0;
+        char* p = output;
+        while ((p = strstr(p, "error")) != NULL) {
+            error_count++;
+            p++;
+        }
+        
+        if (error_count == 1 && strstr(output, "expected 0 arguments") != NULL) {
+            // Linear parsing keeps the per-KB cost flat across sizes
+            printf("  %4zu KB line: %.3fs over baseline, %.1f us/KB\n",
+                   sizes[i] / 1024, time_spent, time_spent * 1e6 / (sizes[i] / 1024));
+        } else if (first_failed == 0) {
+            first_failed = sizes[i];
+        }
+        
+        free(line);
+    }
+    
+    if (first_failed == 0) {
+        printf("  PASSED: all line lengths handled\n");
+        return 0;
+    }
+    printf("  NOTE: %zu KB line not handled, maximum line length varies by implementation\n",
+           first_failed / 1024);
+    return 0;
+}
+
+int test_many_diff_commands() {
+    printf("Test: 200 diff commands in input order\n");
+    char output[BUFFER_SIZE];
+    
+    const char* files[] = {"/tmp/smash_stress_diff1", "/tmp/smash_stress_diff2", "/tmp/smash_stress_diff3"};
+    const char* contents[] = {"same\n", "same\n", "other\n"};
+    for (int i = 0; i < 3; i++) {
+        int fd = open(files[i], O_CREAT | O_WRONLY | O_TRUNC, 0644);
+        if (fd >= 0) {
+            write(fd, contents[i], strlen(contents[i]));
+            close(fd);
+        }
+    }
+    
+    char same_cmd[128], other_cmd[128];
+    snprintf(same_cmd, sizeof(same_cmd), "diff %s %s", files[0], files[1]);
+    snprintf(other_cmd, sizeof(other_cmd), "diff %s %s", files[0], files[2]);
+    
+    // Alternate equal and different pairs so any reordering shows up
+    const char* commands[202];
+    for (int i = 0; i < 200; i++) {
+        commands[i] = (i % 2 == 0) ? same_cmd : other_cmd;
+    }
+    commands[200] = "quit";
+    commands[201] = NULL;
+    
+    run_smash_commands_large(commands, 201, output, BUFFER_SIZE, 60);
+    
+    for (int i = 0; i < 3; i++) {
+        unlink(files[i]);
+    }
+    
+    int count = 0;
+    int in_order = 1;
+    char* p = output;
+    while ((p = strstr(p, "smash > ")) != NULL) {
+        p += strlen("smash > ");
+        if ((p[0] == '0' || p[0] == '1') && p[1] == '\n') {
+            if (p[0] - '0' != count % 2) {
+                in_order = 0;
+            }
+            count++;
+        }
+    }
+    
+    if (count == 200 && in_order) {
+        printf("  PASSED: 200 diff results in input order\n");
+        return 0;
+    }
+    printf("  FAILED: Expected 200 alternating results, got %d (in order: %d)\n", count, in_order);
+    return 1;
+}
+
 int test_multiple_aliases() {
     printf("Test: Multiple aliases\n");
     char output[BUFFER_SIZE];
@@ -287,9 +513,14 @@ int main() {
     
     failures += test_many_echo_commands();
     failures += test_many_background_jobs();
+    failures += test_hundred_live_jobs();
+    failures += test_kill_many_jobs();
     failures += test_rapid_cd_changes();
     failures += test_job_id_recycling();
+    failures += test_job_id_lowest_free();
     failures += test_long_command_line();
+    failures += test_long_line_scaling();
+    failures += test_many_diff_commands();
     failures += test_multiple_aliases();
     failures += test_empty_lines();
     
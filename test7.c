@@ -216,6 +216,54 @@ int test_chain_with_failing_first() {
     return 0;  // Don't fail, just note
 }
 
+int test_true_false_chain() {
+    printf("Test: && follows true/false exit status\n");
+    char output[BUFFER_SIZE];
+    
+    const char* commands[] = {
+        "true && echo after_true",
+        "false && echo after_false",
+        "echo first && false && echo after_middle_false",
+        "quit"
+    };
+    
+    run_smash_commands(commands, 4, output, BUFFER_SIZE);
+    
+    if (strstr(output, "after_true") != NULL &&
+        strstr(output, "after_false") == NULL &&
+        strstr(output, "first") != NULL &&
+        strstr(output, "after_middle_false") == NULL) {
+        printf("  PASSED: true continues and false stops the chain\n");
+        return 0;
+    }
+    printf("  FAILED: Expected only after_true and first\n");
+    printf("  Output: %s\n", output);
+    return 1;
+}
+
+int test_external_status_chain() {
+    printf("Test: && follows an external command's exit status\n");
+    char output[BUFFER_SIZE];
+    
+    const char* commands[] = {
+        "ls /this/path/does/not/exist && echo after_failed_ls",
+        "ls / && echo after_ls",
+        "quit"
+    };
+    
+    run_smash_commands(commands, 3, output, BUFFER_SIZE);
+    
+    // The launcher must hand back the child's real exit status
+    if (strstr(output, "after_ls") != NULL &&
+        strstr(output, "after_failed_ls") == NULL) {
+        printf("  PASSED: External exit status drives the chain\n");
+        return 0;
+    }
+    printf("  FAILED: Expected only after_ls\n");
+    printf("  Output: %s\n", output);
+    return 1;
+}
+
 int test_external_chain() {
     printf("Test: External command chain (ls /tmp && echo done)\n");
     char output[BUFFER_SIZE];
@@ -288,6 +336,8 @@ int main() {
     failures += test_triple_chain();
     failures += test_cd_and_pwd();
     failures += test_chain_with_failing_first();
+    failures += test_true_false_chain();
+    failures += test_external_status_chain();
     failures += test_external_chain();
     failures += test_mixed_chain();
     failures += test_background_in_chain();
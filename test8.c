@@ -95,6 +95,43 @@ int test_invalid_command() {
     return 1;
 }
 
+int test_invalid_command_repeated() {
+    printf("Test: Repeated invalid command and absolute path\n");
+    char output[BUFFER_SIZE];
+    
+    const char* commands[] = {
+        "thiscommanddoesnotexist12345",
+        "/bin/echo absolute",
+        "thiscommanddoesnotexist12345",
+        "echo relative",
+        "quit"
+    };
+    
+    run_smash_commands(commands, 5, output, BUFFER_SIZE);
+    
+    // stderr is merged into the output, so each lookup failure must be
+    // reported in sequence with the commands that ran between them
+    const char* expected[] = {"error", "absolute", "error", "relative"};
+    int in_order = 1;
+    char* p = output;
+    for (int i = 0; i < 4 && in_order; i++) {
+        p = strstr(p, expected[i]);
+        if (p == NULL) {
+            in_order = 0;
+        } else {
+            p += strlen(expected[i]);
+        }
+    }
+    
+    if (in_order) {
+        printf("  PASSED: Every invalid command reported\n");
+        return 0;
+    }
+    printf("  FAILED: Expected error, absolute, error, relative in order\n");
+    printf("  Output: %s\n", output);
+    return 1;
+}
+
 int test_cd_too_many_args() {
     printf("Test: cd with too many arguments\n");
     char output[BUFFER_SIZE];
@@ -326,12 +363,43 @@ int test_special_characters_in_args() {
     return 0;
 }
 
+int test_whitespace_between_args() {
+    printf("Test: Repeated spaces and tabs between arguments\n");
+    char output[BUFFER_SIZE];
+    
+    const char* commands[] = {
+        "   echo   spaced \t\t args   ",
+        "\tpwd\t",
+        "quit"
+    };
+    
+    run_smash_commands(commands, 3, output, BUFFER_SIZE);
+    
+    // The tab-wrapped pwd must run the built-in, printing a path after the second prompt
+    char* second_prompt = strstr(output, "smash > ");
+    if (second_prompt != NULL) {
+        second_prompt = strstr(second_prompt + 1, "smash > ");
+    }
+    int pwd_ran = second_prompt != NULL && second_prompt[strlen("smash > ")] == '/';
+    
+    // Runs of whitespace separate arguments and never become empty tokens
+    if (strstr(output, "spaced args\n") != NULL && pwd_ran &&
+        strstr(output, "expected 0 arguments") == NULL) {
+        printf("  PASSED: Whitespace runs split arguments\n");
+        return 0;
+    }
+    printf("  FAILED: Expected 'spaced args', a pwd path and no argument errors\n");
+    printf("  Output: %s\n", output);
+    return 1;
+}
+
 int main() {
     printf("=== Test 8: Error Handling and Edge Cases ===\n\n");
     
     int failures = 0;
     
     failures += test_invalid_command();
+    failures += test_invalid_command_repeated();
     failures += test_cd_too_many_args();
     failures += test_kill_invalid_job();
     failures += test_fg_no_jobs();
@@ -342,6 +410,7 @@ int main() {
     failures += test_showpid_extra_args();
     failures += test_pwd_extra_args();
     failures += test_special_characters_in_args();
+    failures += test_whitespace_between_args();
     
     printf("\n=== Results: %d tests failed ===\n", failures);
     return failures > 0 ? 1 : 0;